@@ -3,6 +3,7 @@
 #include "remove_duplicates.h"
 #include "paginator.h"
 #include "request_queue.h"
+#include "test_sharded_search_server.h"
 
 using namespace std;
 
@@ -11,7 +12,18 @@ void AddDocument(SearchServer& search_server, int document_id, const std::string
 void MatchDocuments(const SearchServer& search_server, const std::string& query);
 void FindTopDocuments(const SearchServer& search_server, const std::string& raw_query);
 
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && argv[1] == "--test"s) {
+        try {
+            TestShardedSearchServer();
+        } catch (const exception& e) {
+            cout << "Test failed: "s << e.what() << endl;
+            return 1;
+        }
+        cout << "Tests passed"s << endl;
+        return 0;
+    }
+
     SearchServer search_server("and with"s);
 
     AddDocument(search_server, 1, "funny pet and nasty rat"s, DocumentStatus::ACTUAL, {7, 2, 7});
@@ -76,4 +88,4 @@ void MatchDocuments(const SearchServer& search_server, const std::string& query)
     } catch (const exception& e) {
         cout << "Error in matchig request "s << query << ": "s << e.what() << endl;
     }
-}
\ No newline at end of file
+}
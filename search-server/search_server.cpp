@@ -31,6 +31,16 @@ std::vector<Document> SearchServer::FindTopDocuments(const std::string& raw_quer
     return FindTopDocuments(raw_query, DocumentStatus::ACTUAL);
 }
 
+std::map<std::string, int> SearchServer::GetQueryWordDocumentCounts(const Query& query) const {
+    std::map<std::string, int> word_document_counts;
+    for (const std::string& word : query.plus_words) {
+        if (word_to_document_freqs_.count(word) > 0) {
+            word_document_counts[word] = word_to_document_freqs_.at(word).size();
+        }
+    }
+    return word_document_counts;
+}
+
 int SearchServer::GetDocumentCount() const {
     return documents_.size();
 }
@@ -154,4 +164,20 @@ SearchServer::Query SearchServer::ParseQuery(const std::string& text) const {
    
 double SearchServer::ComputeWordInverseDocumentFreq(const std::string& word) const {
     return std::log(GetDocumentCount() * 1.0 / word_to_document_freqs_.at(word).size());
+}
+
+// Relevance is compared in PRECISION steps rather than by raw difference, so the order
+// is a strict total one (id is the last key) and the top documents don't depend on
+// how the candidates were gathered (one index or several shards).
+bool CompareDocumentsByRelevance(const Document& lhs, const Document& rhs) {
+    const long long lhs_relevance = std::llround(lhs.relevance / PRECISION);
+    const long long rhs_relevance = std::llround(rhs.relevance / PRECISION);
+    return std::tie(lhs_relevance, lhs.rating, rhs.id) > std::tie(rhs_relevance, rhs.rating, lhs.id);
+}
+
+void SortAndTrimDocuments(std::vector<Document>& documents) {
+    std::sort(documents.begin(), documents.end(), CompareDocumentsByRelevance);
+    if (documents.size() > MAX_RESULT_DOCUMENT_COUNT) {
+        documents.resize(MAX_RESULT_DOCUMENT_COUNT);
+    }
 }
\ No newline at end of file
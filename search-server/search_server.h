@@ -38,6 +38,8 @@ public:
     std::tuple<std::vector<std::string>, DocumentStatus> MatchDocument(const std::string& raw_query, int document_id) const;
     
 private:
+    friend class ShardedSearchServer;
+
     struct DocumentData {
         int rating;
         DocumentStatus status;
@@ -66,12 +68,25 @@ private:
     };
     Query ParseQuery(const std::string& text) const;
 
+    // Ranks documents using externally supplied IDF values instead of local ones,
+    // so that a shard of a larger index scores exactly like the whole index would.
+    template <typename DocumentPredicate>
+    std::vector<Document> FindTopDocuments(const Query& query, DocumentPredicate document_predicate,
+                                           const std::map<std::string, double>& word_inverse_document_freqs) const;
+    std::map<std::string, int> GetQueryWordDocumentCounts(const Query& query) const;
+
     double ComputeWordInverseDocumentFreq(const std::string& word) const;
 
     template <typename DocumentPredicate>
     std::vector<Document> FindAllDocuments(const Query& query,DocumentPredicate document_predicate) const;
+    template <typename DocumentPredicate, typename InverseDocumentFreq>
+    std::vector<Document> FindAllDocuments(const Query& query, DocumentPredicate document_predicate,
+                                           InverseDocumentFreq inverse_document_freq) const;
 };
 
+bool CompareDocumentsByRelevance(const Document& lhs, const Document& rhs);
+void SortAndTrimDocuments(std::vector<Document>& documents);
+
 template <typename StringContainer>
 SearchServer::SearchServer(const StringContainer& stop_words):stop_words_(MakeUniqueNonEmptyStrings(stop_words)) 
 {
@@ -83,31 +98,41 @@ SearchServer::SearchServer(const StringContainer& stop_words):stop_words_(MakeUn
 template <typename DocumentPredicate>
 std::vector<Document> SearchServer::FindTopDocuments(const std::string& raw_query,
                                   DocumentPredicate document_predicate) const {
-    const auto query = ParseQuery(raw_query);
-    auto matched_documents = FindAllDocuments(query, document_predicate);
-    std::sort(matched_documents.begin(), matched_documents.end(),
-     [](const Document& lhs, const Document& rhs) {
-             return lhs.relevance > rhs.relevance
-                 || (std::abs(lhs.relevance - rhs.relevance) < PRECISION && lhs.rating > rhs.rating);
-         });
-    if (matched_documents.size() > MAX_RESULT_DOCUMENT_COUNT) {
-        matched_documents.resize(MAX_RESULT_DOCUMENT_COUNT);
-    }
+    auto matched_documents = FindAllDocuments(ParseQuery(raw_query), document_predicate);
+    SortAndTrimDocuments(matched_documents);
+    return matched_documents;
+}
+
+template <typename DocumentPredicate>
+std::vector<Document> SearchServer::FindTopDocuments(const Query& query, DocumentPredicate document_predicate,
+                                  const std::map<std::string, double>& word_inverse_document_freqs) const {
+    auto matched_documents = FindAllDocuments(query, document_predicate,
+                                              [&word_inverse_document_freqs](const std::string& word) {
+                                                  return word_inverse_document_freqs.at(word);
+                                              });
+    SortAndTrimDocuments(matched_documents);
     return matched_documents;
 }
 
 template <typename DocumentPredicate>
 std::vector<Document> SearchServer::FindAllDocuments(const Query& query,DocumentPredicate document_predicate) const {
+    return FindAllDocuments(query, document_predicate,
+                            [this](const std::string& word) { return ComputeWordInverseDocumentFreq(word); });
+}
+
+template <typename DocumentPredicate, typename InverseDocumentFreq>
+std::vector<Document> SearchServer::FindAllDocuments(const Query& query, DocumentPredicate document_predicate,
+                                  InverseDocumentFreq inverse_document_freq) const {
     std::map<int, double> document_to_relevance;
     for (const std::string& word : query.plus_words) {
         if (word_to_document_freqs_.count(word) == 0) {
             continue;
         }
-        const double inverse_document_freq = ComputeWordInverseDocumentFreq(word);
+        const double word_inverse_document_freq = inverse_document_freq(word);
         for (const auto [document_id, term_freq] : word_to_document_freqs_.at(word)) {
             const auto& document_data = documents_.at(document_id);
             if (document_predicate(document_id, document_data.status, document_data.rating)) {
-                document_to_relevance[document_id] += term_freq * inverse_document_freq;
+                document_to_relevance[document_id] += term_freq * word_inverse_document_freq;
             }
         }
     }
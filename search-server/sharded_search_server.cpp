@@ -0,0 +1,80 @@
+#include "sharded_search_server.h"
+
+#include <cmath>
+
+ShardedSearchServer::ShardedSearchServer(const std::string& stop_words_text, int shard_count)
+    : ShardedSearchServer(SplitIntoWords(stop_words_text), shard_count)
+{
+}
+
+void ShardedSearchServer::AddDocument(int document_id, const std::string& document, DocumentStatus status,
+                 const std::vector<int>& ratings) {
+    if (document_id < 0) {
+        using namespace std;
+        throw invalid_argument("Invalid document_id"s);
+    }
+    GetShard(document_id).AddDocument(document_id, document, status, ratings);
+}
+
+std::vector<Document> ShardedSearchServer::FindTopDocuments(const std::string& raw_query, DocumentStatus status) const {
+    return FindTopDocuments(
+        raw_query, [status](int document_id, DocumentStatus document_status, int rating) {
+            return document_status == status;
+        });
+}
+
+std::vector<Document> ShardedSearchServer::FindTopDocuments(const std::string& raw_query) const {
+    return FindTopDocuments(raw_query, DocumentStatus::ACTUAL);
+}
+
+int ShardedSearchServer::GetDocumentCount() const {
+    int document_count = 0;
+    for (const SearchServer& shard : shards_) {
+        document_count += shard.GetDocumentCount();
+    }
+    return document_count;
+}
+
+int ShardedSearchServer::GetShardCount() const {
+    return shards_.size();
+}
+
+void ShardedSearchServer::RemoveDocument(int document_id) {
+    if (document_id < 0) {
+        return;
+    }
+    GetShard(document_id).RemoveDocument(document_id);
+}
+
+std::tuple<std::vector<std::string>, DocumentStatus> ShardedSearchServer::MatchDocument(const std::string& raw_query, int document_id) const {
+    if (document_id < 0) {
+        using namespace std;
+        throw out_of_range("Invalid document_id"s);
+    }
+    return GetShard(document_id).MatchDocument(raw_query, document_id);
+}
+
+const SearchServer& ShardedSearchServer::GetShard(int document_id) const {
+    return shards_[document_id % shards_.size()];
+}
+
+SearchServer& ShardedSearchServer::GetShard(int document_id) {
+    return shards_[document_id % shards_.size()];
+}
+
+std::map<std::string, double> ShardedSearchServer::ComputeGlobalInverseDocumentFreqs(const SearchServer::Query& query) const {
+    // A few map lookups per shard, cheaper inline than on separate threads.
+    std::map<std::string, int> word_document_counts;
+    for (const SearchServer& shard : shards_) {
+        for (const auto& [word, document_count] : shard.GetQueryWordDocumentCounts(query)) {
+            word_document_counts[word] += document_count;
+        }
+    }
+    // Same formula as SearchServer::ComputeWordInverseDocumentFreq, over the whole collection.
+    const int document_count = GetDocumentCount();
+    std::map<std::string, double> word_inverse_document_freqs;
+    for (const auto& [word, word_document_count] : word_document_counts) {
+        word_inverse_document_freqs[word] = std::log(document_count * 1.0 / word_document_count);
+    }
+    return word_inverse_document_freqs;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "document.h"
+#include "search_server.h"
+
+#include <future>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Splits documents across several SearchServer shards by document id and answers
+// queries by scatter-gather: shards first report document frequencies of the query
+// words, then rank their own documents with the global IDF, and the shard top lists
+// are merged. Results are the same as those of a single SearchServer.
+// Documents are ranked concurrently: one shard on the calling thread, the rest on
+// std::async threads, so a user predicate runs concurrently, one copy per shard.
+class ShardedSearchServer {
+public:
+    template <typename StringContainer>
+    ShardedSearchServer(const StringContainer& stop_words, int shard_count);
+    ShardedSearchServer(const std::string& stop_words_text, int shard_count);
+
+    void AddDocument(int document_id, const std::string& document, DocumentStatus status, const std::vector<int>& ratings);
+
+    template <typename DocumentPredicate>
+    std::vector<Document> FindTopDocuments(const std::string& raw_query, DocumentPredicate document_predicate) const;
+    std::vector<Document> FindTopDocuments(const std::string& raw_query, DocumentStatus status) const;
+    std::vector<Document> FindTopDocuments(const std::string& raw_query) const;
+
+    int GetDocumentCount() const;
+    int GetShardCount() const;
+    void RemoveDocument(int document_id);
+
+    std::tuple<std::vector<std::string>, DocumentStatus> MatchDocument(const std::string& raw_query, int document_id) const;
+
+private:
+    std::vector<SearchServer> shards_;
+
+    const SearchServer& GetShard(int document_id) const;
+    SearchServer& GetShard(int document_id);
+    std::map<std::string, double> ComputeGlobalInverseDocumentFreqs(const SearchServer::Query& query) const;
+
+    template <typename ShardTask>
+    auto RunOnShards(ShardTask shard_task) const;
+};
+
+template <typename StringContainer>
+ShardedSearchServer::ShardedSearchServer(const StringContainer& stop_words, int shard_count) {
+    if (shard_count <= 0) {
+        using namespace std;
+        throw invalid_argument("Shard count must be positive"s);
+    }
+    shards_.reserve(shard_count);
+    for (int i = 0; i < shard_count; ++i) {
+        shards_.emplace_back(stop_words);
+    }
+}
+
+template <typename DocumentPredicate>
+std::vector<Document> ShardedSearchServer::FindTopDocuments(const std::string& raw_query,
+                                  DocumentPredicate document_predicate) const {
+    const auto query = shards_.front().ParseQuery(raw_query);
+    const auto word_inverse_document_freqs = ComputeGlobalInverseDocumentFreqs(query);
+    const auto shard_results = RunOnShards(
+        [&query, &document_predicate, &word_inverse_document_freqs](const SearchServer& shard) {
+            return shard.FindTopDocuments(query, document_predicate, word_inverse_document_freqs);
+        });
+
+    std::vector<Document> matched_documents;
+    for (const auto& shard_result : shard_results) {
+        matched_documents.insert(matched_documents.end(), shard_result.begin(), shard_result.end());
+    }
+    SortAndTrimDocuments(matched_documents);
+    return matched_documents;
+}
+
+template <typename ShardTask>
+auto ShardedSearchServer::RunOnShards(ShardTask shard_task) const {
+    using ShardResult = decltype(shard_task(shards_.front()));
+    std::vector<std::future<ShardResult>> shard_futures;
+    shard_futures.reserve(shards_.size() - 1);
+    for (auto it = std::next(shards_.begin()); it != shards_.end(); ++it) {
+        shard_futures.push_back(std::async(std::launch::async, [&shard_task, &shard = *it] {
+            return shard_task(shard);
+        }));
+    }
+
+    std::vector<ShardResult> shard_results;
+    shard_results.reserve(shards_.size());
+    shard_results.push_back(shard_task(shards_.front()));
+    for (auto& shard_future : shard_futures) {
+        shard_results.push_back(shard_future.get());
+    }
+    return shard_results;
+}
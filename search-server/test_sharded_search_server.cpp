@@ -0,0 +1,112 @@
+#include "test_sharded_search_server.h"
+#include "search_server.h"
+#include "sharded_search_server.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+void Check(bool condition, const string& message) {
+    if (!condition) {
+        throw logic_error(message);
+    }
+}
+
+void CheckSameDocuments(const vector<Document>& expected, const vector<Document>& actual,
+                        int shard_count, const string& query) {
+    const string context = " (shards: "s + to_string(shard_count) + ", query: "s + query + ")"s;
+    Check(expected.size() == actual.size(), "Different result count"s + context);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        Check(expected[i].id == actual[i].id, "Different document at position "s + to_string(i) + context);
+        Check(expected[i].relevance == actual[i].relevance, "Different relevance of document "s
+              + to_string(expected[i].id) + context);
+        Check(expected[i].rating == actual[i].rating, "Different rating of document "s
+              + to_string(expected[i].id) + context);
+    }
+}
+
+template <typename ExceptionType, typename Function>
+void CheckThrows(Function function, const string& message) {
+    try {
+        function();
+    } catch (const ExceptionType&) {
+        return;
+    }
+    throw logic_error(message);
+}
+
+}  // namespace
+
+void TestShardedSearchServer() {
+    const vector<string> queries = {
+        "funny pet"s, "curly hair -nasty"s, "rat"s, "-rat"s, "very nasty funny cat"s, "dog -pet"s,
+        "dog"s, "dog cat"s,
+    };
+    const auto is_banned = [](int document_id, DocumentStatus status, int rating) {
+        return status == DocumentStatus::BANNED;
+    };
+    for (int shard_count : {1, 2, 3, 20, 40}) {
+        SearchServer search_server("and with"s);
+        ShardedSearchServer sharded_server("and with"s, shard_count);
+        const auto add_document = [&](int document_id, const string& document, DocumentStatus status,
+                                      const vector<int>& ratings) {
+            search_server.AddDocument(document_id, document, status, ratings);
+            sharded_server.AddDocument(document_id, document, status, ratings);
+        };
+        // документы 1, 2, 5, 9 и 11 полностью совпадают по релевантности и рейтингу
+        add_document(1, "funny pet and nasty rat"s, DocumentStatus::ACTUAL, {1, 2});
+        add_document(2, "funny pet and nasty rat"s, DocumentStatus::ACTUAL, {1, 2});
+        add_document(3, "funny pet with curly hair"s, DocumentStatus::BANNED, {5});
+        add_document(4, "very nasty rat"s, DocumentStatus::ACTUAL, {-3, 3});
+        add_document(5, "funny pet and nasty rat"s, DocumentStatus::ACTUAL, {1, 2});
+        add_document(6, "curly dog"s, DocumentStatus::BANNED, {4, 4});
+        add_document(7, "funny cat with curly hair"s, DocumentStatus::ACTUAL, {9});
+        add_document(8, "rat rat dog"s, DocumentStatus::IRRELEVANT, {2});
+        add_document(9, "funny pet and nasty rat"s, DocumentStatus::ACTUAL, {1, 2});
+        add_document(10, "very funny pet"s, DocumentStatus::ACTUAL, {7, 1});
+        add_document(11, "funny pet and nasty rat"s, DocumentStatus::ACTUAL, {1, 2});
+        // релевантности по слову dog отличаются меньше чем на PRECISION, но не равны,
+        // так как частоты 9/9 и 11/11 после суммирования не дают ровно 1/1
+        add_document(12, "dog dog dog dog dog dog dog dog dog dog dog"s, DocumentStatus::ACTUAL, {0});
+        add_document(13, "dog cat cat"s, DocumentStatus::ACTUAL, {8});
+        add_document(14, "dog dog dog dog dog cat cat"s, DocumentStatus::ACTUAL, {2});
+        add_document(15, "dog"s, DocumentStatus::ACTUAL, {7});
+        add_document(16, "dog dog dog dog dog dog dog dog dog dog dog cat cat"s, DocumentStatus::ACTUAL, {6});
+        add_document(17, "dog dog dog dog dog dog dog dog cat cat"s, DocumentStatus::ACTUAL, {6});
+        add_document(18, "dog dog dog dog dog dog dog dog dog cat cat"s, DocumentStatus::ACTUAL, {5});
+        add_document(19, "dog dog dog dog dog dog dog dog dog"s, DocumentStatus::ACTUAL, {0});
+
+        const auto check_queries = [&]() {
+            Check(search_server.GetDocumentCount() == sharded_server.GetDocumentCount(),
+                  "Different document count (shards: "s + to_string(shard_count) + ")"s);
+            for (const string& query : queries) {
+                CheckSameDocuments(search_server.FindTopDocuments(query),
+                                   sharded_server.FindTopDocuments(query), shard_count, query);
+                CheckSameDocuments(search_server.FindTopDocuments(query, is_banned),
+                                   sharded_server.FindTopDocuments(query, is_banned), shard_count, query);
+            }
+        };
+        check_queries();
+        Check(sharded_server.FindTopDocuments("-rat"s).empty(), "Query without plus words found documents"s);
+
+        // удаление меняет число документов со словом, а значит и глобальный IDF
+        search_server.RemoveDocument(4);
+        sharded_server.RemoveDocument(4);
+        search_server.RemoveDocument(7);
+        sharded_server.RemoveDocument(7);
+        search_server.RemoveDocument(14);
+        sharded_server.RemoveDocument(14);
+        check_queries();
+
+        CheckThrows<invalid_argument>([&sharded_server] { sharded_server.FindTopDocuments("funny --pet"s); },
+                                      "Invalid query was accepted"s);
+    }
+    for (int shard_count : {0, -1}) {
+        CheckThrows<invalid_argument>([shard_count] { ShardedSearchServer("and with"s, shard_count); },
+                                      "Non-positive shard count was accepted"s);
+    }
+}
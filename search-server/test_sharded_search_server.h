@@ -0,0 +1,5 @@
+#pragma once
+
+// Checks that ShardedSearchServer returns exactly what a single SearchServer returns.
+// Throws std::logic_error describing the first mismatch.
+void TestShardedSearchServer();